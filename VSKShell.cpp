@@ -27,6 +27,7 @@
 #include <wayfire/util/log.hpp>
 
 #include <map>
+#include <algorithm>
 #include <memory>
 #include <wayfire/plugin.hpp>
 
@@ -62,6 +63,34 @@ void VSK::Shell::PluginImpl::init() {
     /** Do not focus notification views */
     output->connect( &onPreViewFocused );
 
+    /** Edge-hover check for auto-hidden panels */
+    wf::get_core().connect( &onPointerMotion );
+    wf::get_core().connect( &onPointerMotionAbs );
+
+    panels[ output ].autoHide = panel_autohide;
+    panel_autohide.set_callback(
+        [ = ] () {
+            panels[ output ].autoHide = panel_autohide;
+
+            if ( panel_autohide ) {
+                output->workspace->reflow_reserved_areas();
+                scheduleHide();
+            }
+
+            /** Put the panels straight back, without sliding from wherever they were */
+            else {
+                mHideTimer.disconnect();
+                output->render->rem_effect( &onSlideFrame );
+                withholdPanels( false );
+
+                mPanelsHiding                 = false;
+                panels[ output ].hideProgress = 0.0;
+
+                output->workspace->reflow_reserved_areas();
+            }
+        }
+    );
+
     QString panelPath = cleanPath( panel_config.value().length() ? QString( panel_config.value().c_str() ) : defPanelPath );
     panelCfg = new QSettings( panelPath, QSettings::IniFormat );
     QString runnerPath = cleanPath( runner_config.value().length() ? QString( runner_config.value().c_str() ) : defRunnerPath );
@@ -118,6 +147,13 @@ void VSK::Shell::PluginImpl::init() {
 
 
 void VSK::Shell::PluginImpl::fini() {
+    mHideTimer.disconnect();
+    output->render->rem_effect( &onSlideFrame );
+    withholdPanels( false );
+
+    /** A new instance on this output starts with the panels shown */
+    panels[ output ].hideProgress = 0.0;
+
     if ( backgrounds[ output ].view ) {
         backgrounds[ output ].view->close();
     }
@@ -167,8 +203,25 @@ void VSK::Shell::PluginImpl::setViewAsPanel( wayfire_view view, wf::output_t *ou
     view->sticky = true;
     view->set_role( wf::VIEW_ROLE_DESKTOP_ENVIRONMENT );
 
+    /** The auto-hide state machine of this instance drives only its own output */
+    bool ownOutput = (output == this->output);
+
+    /** Start out visible; the hide timer will slide it away */
+    if ( panels[ output ].autoHide and ownOutput ) {
+        revealPanels();
+    }
+
+    /** Joining the withheld panels of another output: match their state */
+    else if ( panels[ output ].withheld ) {
+        view->set_visible( false );
+    }
+
     configureView( view, output );
     output->workspace->reflow_reserved_areas();
+
+    if ( panels[ output ].autoHide and ownOutput ) {
+        scheduleHide();
+    }
 }
 
 
@@ -285,6 +338,197 @@ void VSK::Shell::PluginImpl::showNotification( wayfire_view view, wf::output_t *
 }
 
 
+void VSK::Shell::PluginImpl::revealPanels() {
+    mHideTimer.disconnect();
+
+    /** Frame callbacks must flow again before the panel is seen */
+    withholdPanels( false );
+
+    if ( not mPanelsHiding and not mSlide.running() ) {
+        return;
+    }
+
+    mPanelsHiding = false;
+    mSlide.animate( panels[ output ].hideProgress, 0.0 );
+
+    output->render->rem_effect( &onSlideFrame );
+    output->render->add_effect( &onSlideFrame, wf::OUTPUT_EFFECT_PRE );
+    output->render->schedule_redraw();
+}
+
+
+void VSK::Shell::PluginImpl::hidePanels() {
+    if ( mPanelsHiding or not panels[ output ].autoHide ) {
+        return;
+    }
+
+    /** Nothing to hide */
+    if ( not panels[ output ].viewTop and not panels[ output ].viewLeft ) {
+        return;
+    }
+
+    mPanelsHiding = true;
+    mSlide.animate( panels[ output ].hideProgress, 1.0 );
+
+    output->render->rem_effect( &onSlideFrame );
+    output->render->add_effect( &onSlideFrame, wf::OUTPUT_EFFECT_PRE );
+    output->render->schedule_redraw();
+}
+
+
+void VSK::Shell::PluginImpl::scheduleHide() {
+    if ( mPanelsHiding or mHideTimer.is_connected() ) {
+        return;
+    }
+
+    mHideTimer.set_timeout(
+        std::max( 0, (int)autohide_delay ), [ = ] () {
+            /** The user is still interacting with the panel */
+            if ( not isPanelView( mLastFocusView ) and not isPointerOnPanel() ) {
+                hidePanels();
+            }
+
+            return false;
+        }
+    );
+}
+
+
+void VSK::Shell::PluginImpl::withholdPanels( bool withhold ) {
+    if ( panels[ output ].withheld == withhold ) {
+        return;
+    }
+
+    panels[ output ].withheld = withhold;
+
+    /** Stop rendering the panels while they are off the output */
+    if ( panels[ output ].viewTop ) {
+        panels[ output ].viewTop->set_visible( not withhold );
+    }
+
+    if ( panels[ output ].viewLeft ) {
+        panels[ output ].viewLeft->set_visible( not withhold );
+    }
+}
+
+
+bool VSK::Shell::PluginImpl::isPanelView( wayfire_view view ) {
+    if ( not view ) {
+        return false;
+    }
+
+    return (view == panels[ output ].viewTop) or (view == panels[ output ].viewLeft);
+}
+
+
+void VSK::Shell::PluginImpl::slidePanels() {
+    double progress = panels[ output ].hideProgress;
+
+    /** Only move the views: the panel client is not asked to reconfigure */
+    if ( panels[ output ].viewTop ) {
+        auto shown = panels[ output ].shownTop;
+        panels[ output ].viewTop->move( shown.x, shown.y - (int)(progress * (shown.y + shown.height)) );
+    }
+
+    if ( panels[ output ].viewLeft ) {
+        auto shown = panels[ output ].shownLeft;
+        panels[ output ].viewLeft->move( shown.x - (int)(progress * (shown.x + shown.width)), shown.y );
+    }
+}
+
+
+bool VSK::Shell::PluginImpl::isPointerAtEdge() {
+    /** Pointer position relative to this output */
+    auto cursor = wf::get_core().get_cursor_position();
+    auto og     = output->get_layout_geometry();
+
+    double x = cursor.x - og.x;
+    double y = cursor.y - og.y;
+
+    /** The pointer is on some other output */
+    if ( (x < 0) or (y < 0) or (x >= og.width) or (y >= og.height) ) {
+        return false;
+    }
+
+    int edge = std::max( 1, (int)autohide_edge_size );
+
+    bool atTop  = panels[ output ].viewTop and (y < edge);
+    bool atLeft = panels[ output ].viewLeft and (x < edge);
+
+    /** An edge shared with a neighbouring output is a seam, not a screen edge */
+    for ( auto& op : wf::get_core().output_layout->get_outputs() ) {
+        if ( op == output ) {
+            continue;
+        }
+
+        auto other = op->get_layout_geometry();
+
+        if ( (other.y + other.height == og.y) and (cursor.x >= other.x) and (cursor.x < other.x + other.width) ) {
+            atTop = false;
+        }
+
+        if ( (other.x + other.width == og.x) and (cursor.y >= other.y) and (cursor.y < other.y + other.height) ) {
+            atLeft = false;
+        }
+    }
+
+    return atTop or atLeft;
+}
+
+
+bool VSK::Shell::PluginImpl::isPointerOnPanel() {
+    if ( isPointerAtEdge() ) {
+        return true;
+    }
+
+    auto cursor = wf::get_core().get_cursor_position();
+    auto og     = output->get_layout_geometry();
+
+    double x = cursor.x - og.x;
+    double y = cursor.y - og.y;
+
+    for ( auto view : { panels[ output ].viewTop, panels[ output ].viewLeft } ) {
+        if ( view ) {
+            auto geom = view->get_wm_geometry();
+
+            if ( (x >= geom.x) and (x < geom.x + geom.width) and (y >= geom.y) and (y < geom.y + geom.height) ) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+
+void VSK::Shell::PluginImpl::handlePointerMotion() {
+    if ( not panels[ output ].autoHide ) {
+        return;
+    }
+
+    if ( not panels[ output ].viewTop and not panels[ output ].viewLeft ) {
+        return;
+    }
+
+    if ( mPanelsHiding ) {
+        if ( isPointerAtEdge() ) {
+            revealPanels();
+        }
+
+        return;
+    }
+
+    /** Panels are shown: keep them while the pointer is on them */
+    if ( isPointerOnPanel() ) {
+        mHideTimer.disconnect();
+    }
+
+    else {
+        scheduleHide();
+    }
+}
+
+
 DECLARE_WAYFIRE_PLUGIN( wf::per_output_plugin_t<VSK::Shell::PluginImpl> );
 
 /**
@@ -306,7 +550,13 @@ void configureView( wayfire_view view, wf::output_t *output ) {
 
         window.x = workarea.x + (workarea.width - window.width) / 2;
         window.y = workarea.y;
-        panels[ output ].viewTop = view;
+        panels[ output ].viewTop  = view;
+        panels[ output ].shownTop = window;
+
+        /** Auto-hide: slide up, past the top edge of the output */
+        if ( panels[ output ].autoHide ) {
+            window.y -= (int)(panels[ output ].hideProgress * (workarea.y + window.height));
+        }
 
         if ( panels[ output ].anchorTop == nullptr ) {
             panels[ output ].anchorTop           = std::make_unique<wf::workspace_manager::anchored_area>();
@@ -318,7 +568,7 @@ void configureView( wayfire_view view, wf::output_t *output ) {
         }
 
         panels[ output ].anchorTop->edge          = wf::workspace_manager::ANCHORED_EDGE_TOP;
-        panels[ output ].anchorTop->reserved_size = window.height;
+        panels[ output ].anchorTop->reserved_size = (panels[ output ].autoHide ? 0 : window.height);
         panels[ output ].anchorTop->real_size     = window.height;
     }
 
@@ -331,7 +581,13 @@ void configureView( wayfire_view view, wf::output_t *output ) {
 
         window.x = workarea.x;
         window.y = workarea.y + (workarea.height - window.height) / 2;
-        panels[ output ].viewLeft = view;
+        panels[ output ].viewLeft  = view;
+        panels[ output ].shownLeft = window;
+
+        /** Auto-hide: slide left, past the left edge of the output */
+        if ( panels[ output ].autoHide ) {
+            window.x -= (int)(panels[ output ].hideProgress * (workarea.x + window.width));
+        }
 
         if ( panels[ output ].anchorLeft == nullptr ) {
             panels[ output ].anchorLeft           = std::make_unique<wf::workspace_manager::anchored_area>();
@@ -343,7 +599,7 @@ void configureView( wayfire_view view, wf::output_t *output ) {
         }
 
         panels[ output ].anchorLeft->edge          = wf::workspace_manager::ANCHORED_EDGE_LEFT;
-        panels[ output ].anchorLeft->reserved_size = window.width;
+        panels[ output ].anchorLeft->reserved_size = (panels[ output ].autoHide ? 0 : window.width);
         panels[ output ].anchorLeft->real_size     = window.width;
     }
 
@@ -35,6 +35,8 @@
 #include <wayfire/render-manager.hpp>
 #include <wayfire/workspace-manager.hpp>
 #include <wayfire/signal-definitions.hpp>
+#include <wayfire/util/duration.hpp>
+#include <wayfire/util.hpp>
 
 #include <wayfire/plugin.hpp>
 #include <wayfire/per-output-plugin.hpp>
@@ -57,6 +59,19 @@ struct PanelView {
     nonstd::observer_ptr<wf::view_interface_t>            viewLeft;
     std::unique_ptr<wf::workspace_manager::anchored_area> anchorTop;
     std::unique_ptr<wf::workspace_manager::anchored_area> anchorLeft;
+
+    /** Auto-hide: reserve no space, and slide the panels off the output when idle */
+    bool autoHide = false;
+
+    /** 0.0 is fully shown, 1.0 is fully slid off the output */
+    double hideProgress = 0.0;
+
+    /** Geometry of the fully shown panels, the base of the slide */
+    wf::geometry_t shownTop;
+    wf::geometry_t shownLeft;
+
+    /** The panel views have been made invisible while off the output */
+    bool withheld = false;
 };
 
 static std::map<wf::output_t *, BackgroundView> backgrounds;
@@ -73,6 +88,17 @@ class VSK::Shell::PluginImpl : public wf::per_output_plugin_instance_t {
         void showRunner( wayfire_view, wf::output_t *output );
         void showNotification( wayfire_view, wf::output_t *output );
 
+        /** Auto-hide helpers */
+        void revealPanels();
+        void hidePanels();
+        void scheduleHide();
+        void withholdPanels( bool withhold );
+        bool isPanelView( wayfire_view );
+        void slidePanels();
+        bool isPointerAtEdge();
+        bool isPointerOnPanel();
+        void handlePointerMotion();
+
         wayfire_view mLastFocusView;
 
         wayfire_view mRunnerView;
@@ -90,6 +116,16 @@ class VSK::Shell::PluginImpl : public wf::per_output_plugin_instance_t {
         wf::option_wrapper_t<std::string> runner_config{ "vsk-shell/runner_config_file" };
         wf::option_wrapper_t<std::string> notify_config{ "vsk-shell/notify_config_file" };
 
+        wf::option_wrapper_t<bool> panel_autohide{ "vsk-shell/panel_autohide" };
+        wf::option_wrapper_t<int> autohide_edge_size{ "vsk-shell/autohide_edge_size" };
+        wf::option_wrapper_t<int> autohide_delay{ "vsk-shell/autohide_delay" };
+        wf::option_wrapper_t<int> autohide_duration{ "vsk-shell/autohide_duration" };
+
+        /** Panel slide animation, and the delay before hiding */
+        wf::animation::simple_animation_t mSlide{ autohide_duration };
+        wf::wl_timer mHideTimer;
+        bool mPanelsHiding = false;
+
         QString defPanelPath  = QDir::home().filePath( ".config/lxqt/panel.conf" );
         QString defRunnerPath = QDir::home().filePath( ".config/lxqt/lxqt-runner.conf" );
         QString defNotifyPath = QDir::home().filePath( ".config/lxqt/notifications.conf" );
@@ -264,10 +300,51 @@ class VSK::Shell::PluginImpl : public wf::per_output_plugin_instance_t {
 
                     else {
                         mLastFocusView = ev->view;
+
+                        /** Keep the panel around while it has the focus */
+                        if ( panels[ output ].autoHide ) {
+                            if ( isPanelView( ev->view ) ) {
+                                revealPanels();
+                            }
+
+                            else {
+                                scheduleHide();
+                            }
+                        }
                     }
                 }
             };
 
+        /** Drive the panel slide animation */
+        wf::effect_hook_t onSlideFrame =
+            [ = ] () {
+                panels[ output ].hideProgress = mSlide;
+                slidePanels();
+
+                if ( mSlide.running() ) {
+                    output->render->schedule_redraw();
+                    return;
+                }
+
+                output->render->rem_effect( &onSlideFrame );
+
+                /** Fully off the output: stop rendering the panel */
+                if ( mPanelsHiding ) {
+                    withholdPanels( true );
+                }
+            };
+
+        /** Reveal the hidden panels when the pointer touches the edge of the output */
+        wf::signal::connection_t<wf::post_input_event_signal<wlr_pointer_motion_event> > onPointerMotion =
+            [ = ] (wf::post_input_event_signal<wlr_pointer_motion_event> *) {
+                handlePointerMotion();
+            };
+
+        wf::signal::connection_t<wf::post_input_event_signal<wlr_pointer_motion_absolute_event> > onPointerMotionAbs =
+            [ = ] (wf::post_input_event_signal<wlr_pointer_motion_absolute_event> *) {
+                handlePointerMotion();
+            };
+
         /** To reposition the notification views */
         wf::signal::connection_t<wf::view_geometry_changed_signal> onNotifyViewResized =
             [ = ] (wf::view_geometry_changed_signal *ev) {